@@ -7,11 +7,123 @@ static Layer *s_simple_bg_layer, *s_date_layer, *s_hands_layer, *s_digit_layer;
 static TextLayer *s_hour_label, *s_minute_label, *s_hour_label2, *s_minute_label2, *s_day_label, *s_num_label, *s_num_label2, *s_bt_label, *s_bt_label2;
 
 static GPath *s_tick_paths[NUM_CLOCK_TICKS];
-static GPath *s_minute_arrow, *s_hour_arrow;
+static GPath *s_minute_arrow, *s_hour_arrow, *s_tz2_arrow;
 static char s_num_buffer[12], s_day_buffer[6];
 static char s_bt_buffer[12];
 static bool bt_cond = true;
 static char s_digit_minute_buffer[10], s_digit_hour_buffer[6];
+static Settings s_settings;  // init で1回だけ persist から読み込む
+static int32_t s_tz2_delta;   // 第2タイムゾーンとローカル時刻の差（分）
+static int32_t s_local_gmtoff;  // s_tz2_delta を計算したときのローカルの UTC オフセット（秒）
+
+#if TICK_STATS
+// 秒針の計測 ========================================================================
+// 遅延ヒストグラムの区切り（ms）。最後の区間はそれ以上すべて
+static const uint16_t s_stats_bounds[] = { 10, 20, 50, 100, 200, 500, 1000 };
+#define STATS_NUM_BUCKETS (ARRAY_LENGTH(s_stats_bounds) + 1)
+
+static struct {
+  uint32_t tick_ms;         // 直近の tick の時刻（ms）
+  bool tick_pending;        // tick 後にまだ描画されていない
+  int last_tick_sec;        // 直近の tick の秒（-1 は未受信）
+  int last_draw_sec;        // 直近に tick で描画した秒（-1 は未描画）
+  uint16_t hist[STATS_NUM_BUCKETS];
+  uint16_t max_ms;
+  uint16_t ticks, draws, extra_draws;
+  uint16_t overruns;        // 前の tick が描画される前に次の tick が来た回数
+  uint16_t tick_skipped, tick_doubled;
+  uint16_t draw_skipped, draw_doubled;
+} s_stats = { .last_tick_sec = -1, .last_draw_sec = -1 };
+
+// 現在時刻を ms で取得（差分を取るだけなので桁あふれは気にしない）
+static uint32_t stats_now_ms() {
+  time_t sec;
+  uint16_t ms;
+  time_ms(&sec, &ms);
+  return (uint32_t)sec * 1000 + ms;
+}
+
+// 前回の秒との差から、秒の飛び・重複を数える
+static void stats_count_step(int prev_sec, int sec, uint16_t *skipped, uint16_t *doubled) {
+  // 分単位の tick では秒の飛びは数えない
+  if (prev_sec < 0 || !(s_settings.flags & SETTINGS_FLAG_SECONDS)) {
+    return;
+  }
+  int step = (sec - prev_sec + 60) % 60;
+  if (step == 0) {
+    (*doubled)++;
+  } else if (step > 1) {
+    *skipped += step - 1;
+  }
+}
+
+// tick を受けたときの記録
+static void stats_on_tick(struct tm *tick_time) {
+  uint32_t now_ms = stats_now_ms();
+  // 前の tick がまだ描画されていない。その tick は最後の区間に入れ、
+  // 少なくとも今までの待ち時間を最大遅延に反映する
+  if (s_stats.tick_pending) {
+    uint32_t waited = now_ms - s_stats.tick_ms;
+    uint16_t waited_ms = waited > UINT16_MAX ? UINT16_MAX : waited;
+    s_stats.overruns++;
+    s_stats.hist[STATS_NUM_BUCKETS - 1]++;
+    s_stats.max_ms = waited_ms > s_stats.max_ms ? waited_ms : s_stats.max_ms;
+  }
+  s_stats.tick_ms = now_ms;
+  s_stats.tick_pending = true;
+  s_stats.ticks++;
+  stats_count_step(s_stats.last_tick_sec, tick_time->tm_sec, &s_stats.tick_skipped, &s_stats.tick_doubled);
+  s_stats.last_tick_sec = tick_time->tm_sec;
+}
+
+// 針を描画したときの記録
+static void stats_on_draw(int sec) {
+  s_stats.draws++;
+  if (s_stats.tick_pending) {
+    uint32_t latency = stats_now_ms() - s_stats.tick_ms;
+    uint16_t latency_ms = latency > UINT16_MAX ? UINT16_MAX : latency;
+    unsigned int i = 0;
+    while (i < ARRAY_LENGTH(s_stats_bounds) && latency_ms >= s_stats_bounds[i]) {
+      i++;
+    }
+    s_stats.hist[i]++;
+    s_stats.max_ms = latency_ms > s_stats.max_ms ? latency_ms : s_stats.max_ms;
+    s_stats.tick_pending = false;
+    // 秒の飛び・重複は tick による描画どうしでだけ比べる
+    stats_count_step(s_stats.last_draw_sec, sec, &s_stats.draw_skipped, &s_stats.draw_doubled);
+    s_stats.last_draw_sec = sec;
+  } else {
+    // tick 以外（他レイヤーの更新など）による再描画
+    s_stats.extra_draws++;
+  }
+}
+
+// 集計をログに出力してリセット
+static void stats_report() {
+  APP_LOG(APP_LOG_LEVEL_INFO, "tick_stats: ticks:%d draws:%d extra:%d overrun:%d max:%dms",
+    s_stats.ticks, s_stats.draws, s_stats.extra_draws, s_stats.overruns, s_stats.max_ms);
+  APP_LOG(APP_LOG_LEVEL_INFO, "tick_stats: tick skipped:%d doubled:%d  draw skipped:%d doubled:%d",
+    s_stats.tick_skipped, s_stats.tick_doubled, s_stats.draw_skipped, s_stats.draw_doubled);
+
+  // ヒストグラムの見出しは s_stats_bounds から作る
+  char line[128];
+  int len = 0;
+  for (unsigned int i = 0; i < STATS_NUM_BUCKETS && len < (int)sizeof(line); i++) {
+    if (i < ARRAY_LENGTH(s_stats_bounds)) {
+      len += snprintf(line + len, sizeof(line) - len, "<%d:%d ", s_stats_bounds[i], s_stats.hist[i]);
+    } else {
+      len += snprintf(line + len, sizeof(line) - len, ">=%d:%d", s_stats_bounds[i - 1], s_stats.hist[i]);
+    }
+  }
+  APP_LOG(APP_LOG_LEVEL_INFO, "tick_stats: %s", line);
+
+  s_stats.ticks = s_stats.draws = s_stats.extra_draws = s_stats.max_ms = 0;
+  s_stats.overruns = 0;
+  s_stats.tick_skipped = s_stats.tick_doubled = 0;
+  s_stats.draw_skipped = s_stats.draw_doubled = 0;
+  memset(s_stats.hist, 0, sizeof(s_stats.hist));
+}
+#endif
 
 // 背景の更新 ========================================================================
 static void bg_update_proc(Layer *layer, GContext *ctx) {
@@ -28,6 +140,15 @@ static void bg_update_proc(Layer *layer, GContext *ctx) {
   }
 }
 
+// 第2タイムゾーンの時差の更新 ========================================================================
+// gmtoff はローカル時刻の UTC オフセット（秒）。struct tm の tm_gmtoff を渡す
+static void update_tz2_delta(int32_t gmtoff) {
+  // 描画のたびに計算しないよう、ローカル時刻との差を分で覚えておく
+  s_local_gmtoff = gmtoff;
+  s_tz2_delta = s_settings.tz2_offset - gmtoff / 60;
+  // APP_LOG(APP_LOG_LEVEL_DEBUG, "update_tz2_delta: local:%d tz2:%d delta:%d", (int)(gmtoff / 60), (int)s_settings.tz2_offset, (int)s_tz2_delta);
+}
+
 // 針の更新 ========================================================================
 static void hands_update_proc(Layer *layer, GContext *ctx) {
   // レイヤーの矩形と中心を取得
@@ -39,8 +160,8 @@ static void hands_update_proc(Layer *layer, GContext *ctx) {
   struct tm *t = localtime(&now);
   
   //------ 短針　-------
-  // 塗る色を白に、枠線を黒にする
-  graphics_context_set_fill_color(ctx, GColorWhite);
+  // 塗る色を設定の色に、枠線を黒にする
+  graphics_context_set_fill_color(ctx, (GColor){ .argb = s_settings.hour_color });
   graphics_context_set_stroke_color(ctx, GColorBlack);
 
   // 短針を時の角度に回転する
@@ -49,12 +170,8 @@ static void hands_update_proc(Layer *layer, GContext *ctx) {
   gpath_draw_outline(ctx, s_hour_arrow);
 
   //------ 長針　-------
-  // 塗る色を白に、枠線を黒にする
-  #ifdef PBL_COLOR
-    graphics_context_set_fill_color(ctx, GColorRed);
-  #else
-    graphics_context_set_fill_color(ctx, GColorWhite);
-  #endif
+  // 塗る色を設定の色に、枠線を黒にする
+  graphics_context_set_fill_color(ctx, (GColor){ .argb = s_settings.minute_color });
   graphics_context_set_stroke_color(ctx, GColorBlack);
 
   // 長針を分の角度に回転する
@@ -64,70 +181,88 @@ static void hands_update_proc(Layer *layer, GContext *ctx) {
   gpath_draw_outline(ctx, s_minute_arrow);
 
   //------ 秒針　-------
-  // 秒針の長さを算出。PebbleRound なら前者、違えば後者
-  const int16_t second_hand_length = PBL_IF_ROUND_ELSE((bounds.size.w / 2) - 19, bounds.size.w / 2);
+  // 秒針なしの設定なら計算もしない
+  if (s_settings.flags & SETTINGS_FLAG_SECONDS) {
+    // 秒針の長さを算出。PebbleRound なら前者、違えば後者
+    const int16_t second_hand_length = PBL_IF_ROUND_ELSE((bounds.size.w / 2) - 19, bounds.size.w / 2);
 
-  // 秒針の角度を算出 （TRIG_MAX_ANGLE は360度のこと）
-  int32_t second_angle = TRIG_MAX_ANGLE * t->tm_sec / 60;
+    // 秒針の角度を算出 （TRIG_MAX_ANGLE は360度のこと）
+    int32_t second_angle = TRIG_MAX_ANGLE * t->tm_sec / 60;
   
-  // 秒針の先端位置を算出
-  GPoint second_hand = {
-    .x = (int16_t)(sin_lookup(second_angle) * (int32_t)second_hand_length / TRIG_MAX_RATIO) + center.x,
-    .y = (int16_t)(-cos_lookup(second_angle) * (int32_t)second_hand_length / TRIG_MAX_RATIO) + center.y,
-  };
+    // 秒針の先端位置を算出
+    GPoint second_hand = {
+      .x = (int16_t)(sin_lookup(second_angle) * (int32_t)second_hand_length / TRIG_MAX_RATIO) + center.x,
+      .y = (int16_t)(-cos_lookup(second_angle) * (int32_t)second_hand_length / TRIG_MAX_RATIO) + center.y,
+    };
+
+    // 秒針の描画
+    graphics_context_set_stroke_color(ctx, (GColor){ .argb = s_settings.second_color });
+    graphics_draw_line(ctx, second_hand, center);
+  }
 
-  // 秒針の描画
-  graphics_context_set_stroke_color(ctx, GColorWhite);
-  graphics_draw_line(ctx, second_hand, center);
+  //------ 第2タイムゾーンの24時間針　-------
+  if (s_tz2_arrow) {
+    // 24時間で1周。0時が真上
+    int32_t tz2_min = ((t->tm_hour * 60 + t->tm_min + s_tz2_delta) % (24 * 60) + (24 * 60)) % (24 * 60);
+    graphics_context_set_fill_color(ctx, (GColor){ .argb = s_settings.tz2_color });
+    graphics_context_set_stroke_color(ctx, GColorBlack);
+    gpath_rotate_to(s_tz2_arrow, TRIG_MAX_ANGLE * tz2_min / (24 * 60));
+    gpath_draw_filled(ctx, s_tz2_arrow);
+    gpath_draw_outline(ctx, s_tz2_arrow);
+  }
 
   // 中心に黒点を打つ
   graphics_context_set_fill_color(ctx, GColorBlack);
   graphics_fill_rect(ctx, GRect(bounds.size.w / 2 - 1, bounds.size.h / 2 - 1, 3, 3), 0, GCornerNone);
 
-  // 時報
-  if(t->tm_min == 0 && t->tm_sec == 0){
-    switch (t->tm_hour % 12) {
-      case 1:
-        vibes_enqueue_custom_pattern(pat_01);
-        break;
-      case 2:
-        vibes_enqueue_custom_pattern(pat_02);
-        break;
-      case 3:
-        vibes_enqueue_custom_pattern(pat_03);
-        break;
-      case 4:
-        vibes_enqueue_custom_pattern(pat_04);
-        break;
-      case 5:
-        vibes_enqueue_custom_pattern(pat_05);
-        break;
-      case 6:
-        vibes_enqueue_custom_pattern(pat_06);
-        break;
-      case 7:
-        vibes_enqueue_custom_pattern(pat_07);
-        break;
-      case 8:
-        vibes_enqueue_custom_pattern(pat_08);
-        break;
-      case 9:
-        vibes_enqueue_custom_pattern(pat_09);
-        break;
-      case 10:
-        vibes_enqueue_custom_pattern(pat_10);
-        break;
-      case 11:
-        vibes_enqueue_custom_pattern(pat_11);
-        break;
-      case 0:
-        vibes_enqueue_custom_pattern(pat_12);
-        break;
-    }
-  }
+  #if TICK_STATS
+    stats_on_draw(t->tm_sec);
+  #endif
 }
 
 
+// 時報 ========================================================================
+static void hourly_chime(int hour) {
+  switch (hour % 12) {
+    case 1:
+      vibes_enqueue_custom_pattern(pat_01);
+      break;
+    case 2:
+      vibes_enqueue_custom_pattern(pat_02);
+      break;
+    case 3:
+      vibes_enqueue_custom_pattern(pat_03);
+      break;
+    case 4:
+      vibes_enqueue_custom_pattern(pat_04);
+      break;
+    case 5:
+      vibes_enqueue_custom_pattern(pat_05);
+      break;
+    case 6:
+      vibes_enqueue_custom_pattern(pat_06);
+      break;
+    case 7:
+      vibes_enqueue_custom_pattern(pat_07);
+      break;
+    case 8:
+      vibes_enqueue_custom_pattern(pat_08);
+      break;
+    case 9:
+      vibes_enqueue_custom_pattern(pat_09);
+      break;
+    case 10:
+      vibes_enqueue_custom_pattern(pat_10);
+      break;
+    case 11:
+      vibes_enqueue_custom_pattern(pat_11);
+      break;
+    case 0:
+      vibes_enqueue_custom_pattern(pat_12);
+      break;
+  }
+}
+
 // 時刻文字表示の更新 ========================================================================
 static void digit_update_proc(Layer *layer, GContext *ctx) {
 
@@ -139,7 +274,7 @@ static void digit_update_proc(Layer *layer, GContext *ctx) {
   #define BOTTOM_LIMIT            PBL_IF_ROUND_ELSE(180-22,168-22)
   #define RIGHT_LIMIT             PBL_IF_ROUND_ELSE(180-22,144-22)
   #define RIGHT_LIMIT_LONG        PBL_IF_ROUND_ELSE(180-45,144-45)
-  #define ANGLE_MERGE             TRIG_MAX_ANGLE * 18 / 360 
+  #define ANGLE_MERGE             (TRIG_MAX_ANGLE * s_settings.angle_merge / 360)
   
   // 前回のテキストレイヤーを削除
   text_layer_destroy(s_minute_label2);
@@ -339,8 +474,25 @@ static void date_update_proc(Layer *layer, GContext *ctx) {
   //text_layer_set_text(s_day_label, s_day_buffer);
 }
 
-// 秒タイマー ========================================================================
-static void handle_second_tick(struct tm *tick_time, TimeUnits units_changed) {
+// 秒（分）タイマー ========================================================================
+static void handle_tick(struct tm *tick_time, TimeUnits units_changed) {
+  #if TICK_STATS
+    // 1分ごとに集計をログに出す
+    if (units_changed & MINUTE_UNIT) {
+      stats_report();
+    }
+    stats_on_tick(tick_time);
+  #endif
+  if (units_changed & HOUR_UNIT) {
+    // 時報（時計合わせなどで正時以外に HOUR_UNIT が来たときは鳴らさない）
+    if ((s_settings.flags & SETTINGS_FLAG_CHIME) && tick_time->tm_min == 0) {
+      hourly_chime(tick_time->tm_hour);
+    }
+  }
+  // ローカルの UTC オフセットが変わったら（夏時間・タイムゾーン変更）時差を再計算
+  if (s_tz2_arrow && tick_time->tm_gmtoff != s_local_gmtoff) {
+    update_tz2_delta(tick_time->tm_gmtoff);
+  }
   layer_mark_dirty(window_get_root_layer(s_window));
   // Layerを”dirty”にマークするものらしい。
   // dirtyにマークされたレイヤーは、システムが再描画（update_proc呼び出し）してくれるそうだ。
@@ -359,6 +511,143 @@ static void handle_bluetooth(bool connected) {
   }
 }
 
+// 設定の読み込み ========================================================================
+static void load_settings() {
+  s_settings = DEFAULT_SETTINGS;
+  if (persist_exists(PERSIST_KEY_SETTINGS)) {
+    Settings stored;
+    // 長さかバージョンが合わないものは捨てて既定値を使う
+    if (persist_read_data(PERSIST_KEY_SETTINGS, &stored, sizeof(stored)) == sizeof(stored) &&
+        stored.version == SETTINGS_VERSION) {
+      s_settings = stored;
+    }
+  }
+}
+
+// タイマーの設定 ========================================================================
+static void subscribe_tick() {
+  // 秒針がなければ分単位で十分
+  tick_timer_service_subscribe((s_settings.flags & SETTINGS_FLAG_SECONDS) ? SECOND_UNIT : MINUTE_UNIT, handle_tick);
+}
+
+// 第2タイムゾーンの針の作成・破棄 ========================================================================
+static void create_tz2_arrow() {
+  Layer *window_layer = window_get_root_layer(s_window);
+  GRect bounds = layer_get_bounds(window_layer);
+  s_tz2_arrow = gpath_create(&TZ2_HAND_POINTS);
+  gpath_move_to(s_tz2_arrow, grect_center_point(&bounds));
+  // 最初の1回だけは tick を待たずに現在のオフセットを取る
+  time_t now = time(NULL);
+  update_tz2_delta(localtime(&now)->tm_gmtoff);
+}
+
+static void destroy_tz2_arrow() {
+  if (s_tz2_arrow) {
+    gpath_destroy(s_tz2_arrow);
+    s_tz2_arrow = NULL;
+  }
+}
+
+// デジタルレイヤーの作成・破棄 ========================================================================
+static void create_digit_layer(Layer *window_layer) {
+  s_digit_layer = layer_create(layer_get_bounds(window_layer));
+  // デジタルレイヤーが更新されたときのコールバック関数に digit_update_proc を設定
+  layer_set_update_proc(s_digit_layer, digit_update_proc);
+  // デジタルレイヤーを追加（日付レイヤーがあればその下）
+  if (s_date_layer) {
+    layer_insert_below_sibling(s_digit_layer, s_date_layer);
+  } else {
+    layer_add_child(window_layer, s_digit_layer);
+  }
+}
+
+static void destroy_digit_layer() {
+  // digit_update_proc で作ったテキストレイヤーも破棄
+  text_layer_destroy(s_hour_label);
+  text_layer_destroy(s_minute_label);
+  text_layer_destroy(s_hour_label2);
+  text_layer_destroy(s_minute_label2);
+  s_hour_label = s_minute_label = s_hour_label2 = s_minute_label2 = NULL;
+  if (s_digit_layer) {
+    layer_destroy(s_digit_layer);
+    s_digit_layer = NULL;
+  }
+}
+
+// スマホからの設定の受信 ========================================================================
+// オン・オフ項目の受信
+static void read_flag(DictionaryIterator *iter, uint32_t key, uint8_t flag, Settings *settings) {
+  Tuple *t = dict_find(iter, key);
+  if (t) {
+    settings->flags = t->value->int32 ? (settings->flags | flag) : (settings->flags & ~flag);
+  }
+}
+
+// 色項目の受信（0xRRGGBB で届く）
+static void read_color(DictionaryIterator *iter, uint32_t key, uint8_t *color) {
+  Tuple *t = dict_find(iter, key);
+  if (t) {
+    *color = GColorFromHEX(t->value->int32).argb;
+  }
+}
+
+static void handle_inbox_received(DictionaryIterator *iter, void *context) {
+  Settings old = s_settings;
+  Tuple *t;
+
+  read_flag(iter, MESSAGE_KEY_SecondHand, SETTINGS_FLAG_SECONDS, &s_settings);
+  read_flag(iter, MESSAGE_KEY_ShowDigits, SETTINGS_FLAG_DIGITS, &s_settings);
+  read_flag(iter, MESSAGE_KEY_HourlyChime, SETTINGS_FLAG_CHIME, &s_settings);
+  read_flag(iter, MESSAGE_KEY_Tz2Enabled, SETTINGS_FLAG_TZ2, &s_settings);
+  read_color(iter, MESSAGE_KEY_HourColor, &s_settings.hour_color);
+  read_color(iter, MESSAGE_KEY_MinuteColor, &s_settings.minute_color);
+  read_color(iter, MESSAGE_KEY_SecondColor, &s_settings.second_color);
+  read_color(iter, MESSAGE_KEY_DateColor, &s_settings.date_color);
+  read_color(iter, MESSAGE_KEY_Tz2Color, &s_settings.tz2_color);
+  if ((t = dict_find(iter, MESSAGE_KEY_AngleMerge))) {
+    // 0〜180度に丸める
+    int32_t angle = t->value->int32;
+    s_settings.angle_merge = angle < 0 ? 0 : (angle > 180 ? 180 : angle);
+  }
+  if ((t = dict_find(iter, MESSAGE_KEY_Tz2Offset))) {
+    // UTC-12:00〜+14:00 に丸める（設定画面の選択肢と同じ範囲）
+    int32_t offset = t->value->int32;
+    s_settings.tz2_offset = offset < -12 * 60 ? -12 * 60 : (offset > 14 * 60 ? 14 * 60 : offset);
+  }
+  s_settings.version = SETTINGS_VERSION;
+
+  // 変化がなければ何もしない
+  if (memcmp(&old, &s_settings, sizeof(Settings)) == 0) {
+    return;
+  }
+  // まとめて1回で保存
+  persist_write_data(PERSIST_KEY_SETTINGS, &s_settings, sizeof(s_settings));
+
+  // 変わったところだけ反映する
+  uint8_t changed = old.flags ^ s_settings.flags;
+  if (changed & SETTINGS_FLAG_SECONDS) {
+    subscribe_tick();
+  }
+  if (changed & SETTINGS_FLAG_DIGITS) {
+    if (s_settings.flags & SETTINGS_FLAG_DIGITS) {
+      create_digit_layer(window_get_root_layer(s_window));
+    } else {
+      destroy_digit_layer();
+    }
+  }
+  if (changed & SETTINGS_FLAG_TZ2) {
+    if (s_settings.flags & SETTINGS_FLAG_TZ2) {
+      create_tz2_arrow();
+    } else {
+      destroy_tz2_arrow();
+    }
+  } else if (s_tz2_arrow && old.tz2_offset != s_settings.tz2_offset) {
+    update_tz2_delta(s_local_gmtoff);
+  }
+  text_layer_set_text_color(s_num_label, (GColor){ .argb = s_settings.date_color });
+  layer_mark_dirty(window_get_root_layer(s_window));
+}
+
 // ウインドウのロード時の処理 ========================================================================
 static void window_load(Window *window) {
   // ルートレイヤーを取得し、その矩形を得る
@@ -379,12 +668,10 @@ static void window_load(Window *window) {
   // 針レイヤーを追加
   layer_add_child(window_layer, s_hands_layer);
 
-  // デジタルレイヤーを作成 --------------------------
-  s_digit_layer = layer_create(bounds);
-  // デジタルレイヤーが更新されたときのコールバック関数に digit_update_proc を設定
-  layer_set_update_proc(s_digit_layer, digit_update_proc);
-  // デジタルレイヤーを追加
-  layer_add_child(window_layer, s_digit_layer);
+  // デジタルレイヤーを作成（表示する設定のときだけ） --------------------------
+  if (s_settings.flags & SETTINGS_FLAG_DIGITS) {
+    create_digit_layer(window_layer);
+  }
 
   // 日付レイヤーを作成 --------------------------
   s_date_layer = layer_create(bounds);
@@ -409,7 +696,7 @@ static void window_load(Window *window) {
   // 日付をセット
   text_layer_set_text(s_num_label, s_num_buffer);
   text_layer_set_background_color(s_num_label, GColorClear);
-  text_layer_set_text_color(s_num_label, GColorCyan);
+  text_layer_set_text_color(s_num_label, (GColor){ .argb = s_settings.date_color });
   text_layer_set_font(s_num_label, fonts_get_system_font(FONT_KEY_BITHAM_30_BLACK));
   layer_add_child(s_date_layer, text_layer_get_layer(s_num_label));
 
@@ -452,12 +739,8 @@ static void window_unload(Window *window) {
   layer_destroy(s_simple_bg_layer);
   layer_destroy(s_date_layer);
   layer_destroy(s_hands_layer);
-  layer_destroy(s_digit_layer);
+  destroy_digit_layer();
 
-  text_layer_destroy(s_hour_label);
-  text_layer_destroy(s_minute_label);
-  text_layer_destroy(s_hour_label2);
-  text_layer_destroy(s_minute_label2);
   text_layer_destroy(s_day_label);
   text_layer_destroy(s_num_label);
   text_layer_destroy(s_num_label2);
@@ -465,6 +748,9 @@ static void window_unload(Window *window) {
 }
 
 static void init() {
+  // 設定を読み込む（window_load で使うのでウインドウより先）
+  load_settings();
+
   // ウインドウの生成
   s_window = window_create();
   window_set_window_handlers(s_window, (WindowHandlers) {
@@ -489,24 +775,35 @@ static void init() {
   gpath_move_to(s_minute_arrow, center);
   gpath_move_to(s_hour_arrow, center);
 
+  // 第2タイムゾーンの針（使う設定のときだけ作る）
+  if (s_settings.flags & SETTINGS_FLAG_TZ2) {
+    create_tz2_arrow();
+  }
+
   // 背景の文字盤の描画データ
   for (int i = 0; i < NUM_CLOCK_TICKS; ++i) {
     s_tick_paths[i] = gpath_create(&ANALOG_BG_POINTS[i]);
   }
 
-  // 秒タイマーを起動
-  tick_timer_service_subscribe(SECOND_UNIT, handle_second_tick);
+  // 秒（分）タイマーを起動
+  subscribe_tick();
 
   // Bluetooth割り込みを有効にする
   connection_service_subscribe((ConnectionHandlers) {
     .pebble_app_connection_handler = handle_bluetooth
   });
 
+  // スマホからの設定を受け取る
+  app_message_register_inbox_received(handle_inbox_received);
+  // 受信は設定11項目（1 + 11 * (7 + 4) = 122 バイト）が入る大きさ。時計からは送らないので送信バッファは持たない
+  app_message_open(128, 0);
+
 }
 
 static void deinit() {
   gpath_destroy(s_minute_arrow);
   gpath_destroy(s_hour_arrow);
+  destroy_tz2_arrow();
 
   for (int i = 0; i < NUM_CLOCK_TICKS; ++i) {
     gpath_destroy(s_tick_paths[i]);
@@ -514,6 +811,7 @@ static void deinit() {
 
   tick_timer_service_unsubscribe();
   connection_service_unsubscribe();
+  app_message_deregister_callbacks();
   window_destroy(s_window);
 }
 
@@ -4,6 +4,12 @@
 
 #define NUM_CLOCK_TICKS 13
 
+// 秒針の計測（tick から描画までの遅延・秒飛び）。1 にするとログに集計を出す
+// `TICK_STATS=1 pebble build` でビルドすると有効になる（wscript 参照）
+#ifndef TICK_STATS
+#define TICK_STATS 0
+#endif
+
 static const struct GPathInfo ANALOG_BG_POINTS[] = {
   { 4,
     (GPoint []) {
@@ -118,6 +124,51 @@ static const GPathInfo HOUR_HAND_POINTS = {
   }
 };
 
+// 第2タイムゾーンの24時間針の図形（文字盤の内側に浮かぶ三角）
+static const GPathInfo TZ2_HAND_POINTS = {
+  3, (GPoint []){
+    {-6, -46},
+    {6, -46},
+    {0, -60}
+  }
+};
+
+// persist のキー
+#define PERSIST_KEY_SETTINGS 2
+
+// 設定（スマホから受け取り、persist に丸ごと1回で書く）
+// 項目を変えたら SETTINGS_VERSION を上げること
+#define SETTINGS_VERSION 2
+
+#define SETTINGS_FLAG_SECONDS (1 << 0)  // 秒針（オフなら分単位の tick）
+#define SETTINGS_FLAG_DIGITS  (1 << 1)  // 時分の数字
+#define SETTINGS_FLAG_CHIME   (1 << 2)  // 時報
+#define SETTINGS_FLAG_TZ2     (1 << 3)  // 第2タイムゾーンの24時間針
+
+typedef struct __attribute__((__packed__)) {
+  uint8_t version;
+  uint8_t flags;          // SETTINGS_FLAG_*
+  uint8_t angle_merge;    // 時分の数字を合体する角度（度）
+  uint8_t hour_color;     // 各色は GColor の argb
+  uint8_t minute_color;
+  uint8_t second_color;
+  uint8_t date_color;
+  uint8_t tz2_color;
+  int16_t tz2_offset;     // 第2タイムゾーンの UTC オフセット（分）
+} Settings;
+
+static const Settings DEFAULT_SETTINGS = {
+  .version = SETTINGS_VERSION,
+  .flags = SETTINGS_FLAG_SECONDS | SETTINGS_FLAG_DIGITS | SETTINGS_FLAG_CHIME,
+  .angle_merge = 18,
+  .hour_color = GColorWhiteARGB8,
+  .minute_color = PBL_IF_COLOR_ELSE(GColorRedARGB8, GColorWhiteARGB8),
+  .second_color = GColorWhiteARGB8,
+  .date_color = PBL_IF_COLOR_ELSE(GColorCyanARGB8, GColorWhiteARGB8),
+  .tz2_color = PBL_IF_COLOR_ELSE(GColorChromeYellowARGB8, GColorWhiteARGB8),
+  .tz2_offset = 0,
+};
+
 // バイブレーションパターンの定義
 #define ON_S 200
 #define OFF_S 200
@@ -0,0 +1,166 @@
+// 設定画面 ========================================================================
+
+// 既定値（時計側の DEFAULT_SETTINGS と合わせること）
+var DEFAULT_SETTINGS = {
+  secondHand: true,
+  showDigits: true,
+  hourlyChime: true,
+  angleMerge: 18,
+  hourColor: 0xFFFFFF,
+  minuteColor: 0xFF0000,
+  secondColor: 0xFFFFFF,
+  dateColor: 0x00FFFF,
+  tz2Enabled: false,
+  tz2Offset: 0,
+  tz2Color: 0xFFAA00
+};
+
+// 色の選択肢
+var COLORS = [
+  ['White', 0xFFFFFF],
+  ['Red', 0xFF0000],
+  ['Orange', 0xFF5500],
+  ['Chrome yellow', 0xFFAA00],
+  ['Yellow', 0xFFFF00],
+  ['Green', 0x00FF00],
+  ['Cyan', 0x00FFFF],
+  ['Blue', 0x0055FF],
+  ['Magenta', 0xFF00FF],
+  ['Light gray', 0xAAAAAA]
+];
+
+// 保存済みの設定を読み込む（ないものは既定値）
+function loadSettings() {
+  var stored = {};
+  try {
+    stored = JSON.parse(localStorage.getItem('settings')) || {};
+  } catch (e) {
+    stored = {};
+  }
+  var settings = {};
+  for (var key in DEFAULT_SETTINGS) {
+    settings[key] = stored[key] === undefined ? DEFAULT_SETTINGS[key] : stored[key];
+  }
+  return settings;
+}
+
+// UTC オフセット（分）を "+09:00" の形式にする
+function formatOffset(minutes) {
+  var sign = minutes < 0 ? '-' : '+';
+  var abs = Math.abs(minutes);
+  var h = Math.floor(abs / 60);
+  var m = abs % 60;
+  return sign + (h < 10 ? '0' : '') + h + ':' + (m < 10 ? '0' : '') + m;
+}
+
+// チェックボックスの HTML
+function checkbox(id, label, checked) {
+  return '<p><label><input type="checkbox" id="' + id + '"' +
+    (checked ? ' checked' : '') + '> ' + label + '</label></p>';
+}
+
+// 色選択の HTML
+function colorSelect(id, label, value) {
+  var html = '<p>' + label + ' <select id="' + id + '">';
+  for (var i = 0; i < COLORS.length; i++) {
+    html += '<option value="' + COLORS[i][1] + '"' +
+      (COLORS[i][1] === value ? ' selected' : '') + '>' + COLORS[i][0] + '</option>';
+  }
+  return html + '</select></p>';
+}
+
+// 設定画面の HTML を組み立てる
+function buildConfigPage(settings) {
+  var options = '';
+  // UTC-12:00 から UTC+14:00 まで15分刻み
+  for (var offset = -12 * 60; offset <= 14 * 60; offset += 15) {
+    options += '<option value="' + offset + '"' +
+      (offset === settings.tz2Offset ? ' selected' : '') + '>UTC' +
+      formatOffset(offset) + '</option>';
+  }
+
+  return '<!DOCTYPE html><html><head>' +
+    '<meta name="viewport" content="width=device-width,initial-scale=1">' +
+    '<title>ana-digi</title></head><body>' +
+    '<h3>Display</h3>' +
+    checkbox('secondHand', 'Second hand (off: update once a minute)', settings.secondHand) +
+    checkbox('showDigits', 'Show hour/minute digits', settings.showDigits) +
+    '<p>Merge digits within <input type="number" id="angleMerge" min="0" max="180" value="' +
+    settings.angleMerge + '"> degrees</p>' +
+    checkbox('hourlyChime', 'Hourly chime', settings.hourlyChime) +
+    '<h3>Colors</h3>' +
+    colorSelect('hourColor', 'Hour hand', settings.hourColor) +
+    colorSelect('minuteColor', 'Minute hand', settings.minuteColor) +
+    colorSelect('secondColor', 'Second hand', settings.secondColor) +
+    colorSelect('dateColor', 'Date', settings.dateColor) +
+    '<h3>Second time zone</h3>' +
+    checkbox('tz2Enabled', 'Show 24-hour hand', settings.tz2Enabled) +
+    '<p><select id="tz2Offset">' + options + '</select></p>' +
+    colorSelect('tz2Color', '24-hour hand', settings.tz2Color) +
+    '<p><button id="save">Save</button></p>' +
+    '<script>' +
+    'function v(id) { return document.getElementById(id); }' +
+    'v("save").onclick = function() {' +
+    '  var s = {' +
+    '    secondHand: v("secondHand").checked,' +
+    '    showDigits: v("showDigits").checked,' +
+    '    hourlyChime: v("hourlyChime").checked,' +
+    '    angleMerge: parseInt(v("angleMerge").value, 10) || 0,' +
+    '    hourColor: parseInt(v("hourColor").value, 10),' +
+    '    minuteColor: parseInt(v("minuteColor").value, 10),' +
+    '    secondColor: parseInt(v("secondColor").value, 10),' +
+    '    dateColor: parseInt(v("dateColor").value, 10),' +
+    '    tz2Enabled: v("tz2Enabled").checked,' +
+    '    tz2Offset: parseInt(v("tz2Offset").value, 10),' +
+    '    tz2Color: parseInt(v("tz2Color").value, 10)' +
+    '  };' +
+    '  location.href = "pebblejs://close#" + encodeURIComponent(JSON.stringify(s));' +
+    '};' +
+    '</script></body></html>';
+}
+
+// 設定を時計に送る（時計側でまとめて1回で保存される）
+function sendSettings(settings) {
+  Pebble.sendAppMessage({
+    'SecondHand': settings.secondHand ? 1 : 0,
+    'ShowDigits': settings.showDigits ? 1 : 0,
+    'HourlyChime': settings.hourlyChime ? 1 : 0,
+    'AngleMerge': settings.angleMerge,
+    'HourColor': settings.hourColor,
+    'MinuteColor': settings.minuteColor,
+    'SecondColor': settings.secondColor,
+    'DateColor': settings.dateColor,
+    'Tz2Enabled': settings.tz2Enabled ? 1 : 0,
+    'Tz2Offset': settings.tz2Offset,
+    'Tz2Color': settings.tz2Color
+  }, function() {
+    console.log('sendSettings: ok');
+  }, function() {
+    console.log('sendSettings: failed');
+  });
+}
+
+Pebble.addEventListener('showConfiguration', function() {
+  var html = buildConfigPage(loadSettings());
+  Pebble.openURL('data:text/html;charset=utf-8,' + encodeURIComponent(html));
+});
+
+Pebble.addEventListener('webviewclosed', function(e) {
+  if (!e || !e.response) {
+    return;
+  }
+  // キャンセル（iOS の "CANCELLED" など）や壊れた応答は無視する
+  var received;
+  try {
+    received = JSON.parse(decodeURIComponent(e.response));
+  } catch (err) {
+    console.log('webviewclosed: ignored response');
+    return;
+  }
+  var settings = loadSettings();
+  for (var key in received) {
+    settings[key] = received[key];
+  }
+  localStorage.setItem('settings', JSON.stringify(settings));
+  sendSettings(settings);
+});